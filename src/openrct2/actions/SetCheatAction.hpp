@@ -666,8 +666,7 @@ private:
 
             for (size_t stationIndex = 0; stationIndex < MAX_STATIONS; stationIndex++)
             {
-                ride->stations[stationIndex].QueueLength = 0;
-                ride->stations[stationIndex].LastPeepInQueue = SPRITE_INDEX_NULL;
+                ride->QueueClear((int32_t)stationIndex);
             }
 
             for (auto trainIndex : ride->vehicles)
@@ -2491,10 +2491,7 @@ static void peep_interact_with_entrance(Peep* peep, int16_t x, int16_t y, TileEl
         peep->action_sprite_image_offset = _unk_F1AEF0;
         peep->interaction_ride_index = rideIndex;
 
-        uint16_t previous_last = ride->stations[stationNum].LastPeepInQueue;
-        ride->stations[stationNum].LastPeepInQueue = peep->sprite_index;
-        peep->next_in_queue = previous_last;
-        ride->stations[stationNum].QueueLength++;
+        ride->QueueInsertGuestAtBack(stationNum, peep);
 
         peep->current_ride = rideIndex;
         peep->current_ride_station = stationNum;
@@ -2931,10 +2928,7 @@ static void peep_interact_with_path(Peep* peep, int16_t x, int16_t y, TileElemen
                     peep->interaction_ride_index = rideIndex;
 
                     // Add the peep to the ride queue.
-                    uint16_t old_last_peep = ride->stations[stationNum].LastPeepInQueue;
-                    ride->stations[stationNum].LastPeepInQueue = peep->sprite_index;
-                    peep->next_in_queue = old_last_peep;
-                    ride->stations[stationNum].QueueLength++;
+                    ride->QueueInsertGuestAtBack(stationNum, peep);
 
                     peep_decrement_num_riders(peep);
                     peep->current_ride = rideIndex;
@@ -3914,32 +3908,7 @@ static void peep_release_balloon(Guest* peep, int16_t spawn_height)
 void Peep::RemoveFromQueue()
 {
     Ride* ride = get_ride(current_ride);
-
-    auto& station = ride->stations[current_ride_station];
-    // Make sure we don't underflow, building while paused might reset it to 0 where peeps have
-    // not yet left the queue.
-    if (station.QueueLength > 0)
-    {
-        station.QueueLength--;
-    }
-
-    if (sprite_index == station.LastPeepInQueue)
-    {
-        station.LastPeepInQueue = next_in_queue;
-        return;
-    }
-
-    auto spriteId = station.LastPeepInQueue;
-    while (spriteId != SPRITE_INDEX_NULL)
-    {
-        Peep* other_peep = GET_PEEP(spriteId);
-        if (sprite_index == other_peep->next_in_queue)
-        {
-            other_peep->next_in_queue = next_in_queue;
-            return;
-        }
-        spriteId = other_peep->next_in_queue;
-    }
+    ride->QueueRemoveGuest(current_ride_station, this);
 }
 
 /**
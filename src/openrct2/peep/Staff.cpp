@@ -1004,42 +1004,56 @@ static bool staff_path_finding_misc(Peep* peep)
  */
 static void staff_entertainer_update_nearby_peeps(Peep* peep)
 {
-    uint16_t spriteIndex;
-    Peep* guest;
+    // Only guests on the tiles around the entertainer can be affected, so look them up through the sprite spatial
+    // index rather than checking every guest in the park.
+    const int32_t minTileX = std::max(peep->x - 96, 0) / 32;
+    const int32_t minTileY = std::max(peep->y - 96, 0) / 32;
+    const int32_t maxTileX = std::min(peep->x + 96, (MAXIMUM_MAP_SIZE_TECHNICAL * 32) - 1) / 32;
+    const int32_t maxTileY = std::min(peep->y + 96, (MAXIMUM_MAP_SIZE_TECHNICAL * 32) - 1) / 32;
 
-    FOR_ALL_GUESTS (spriteIndex, guest)
+    for (int32_t tileY = minTileY; tileY <= maxTileY; tileY++)
     {
-        if (guest->x == LOCATION_NULL)
-            continue;
+        for (int32_t tileX = minTileX; tileX <= maxTileX; tileX++)
+        {
+            uint16_t spriteIndex = sprite_get_first_in_quadrant(tileX * 32, tileY * 32);
+            for (rct_sprite* sprite = nullptr; spriteIndex != SPRITE_INDEX_NULL;
+                 spriteIndex = sprite->generic.next_in_quadrant)
+            {
+                sprite = get_sprite(spriteIndex);
+                if (!sprite->IsPeep() || sprite->peep.type != PEEP_TYPE_GUEST)
+                    continue;
 
-        int16_t z_dist = abs(peep->z - guest->z);
-        if (z_dist > 48)
-            continue;
+                Peep* guest = &sprite->peep;
+                int16_t z_dist = abs(peep->z - guest->z);
+                if (z_dist > 48)
+                    continue;
 
-        int16_t x_dist = abs(peep->x - guest->x);
-        int16_t y_dist = abs(peep->y - guest->y);
+                int16_t x_dist = abs(peep->x - guest->x);
+                int16_t y_dist = abs(peep->y - guest->y);
 
-        if (x_dist > 96)
-            continue;
+                if (x_dist > 96)
+                    continue;
 
-        if (y_dist > 96)
-            continue;
+                if (y_dist > 96)
+                    continue;
 
-        if (peep->state == PEEP_STATE_WALKING)
-        {
-            peep->happiness_target = std::min(peep->happiness_target + 4, PEEP_MAX_HAPPINESS);
-        }
-        else if (peep->state == PEEP_STATE_QUEUING)
-        {
-            if (peep->time_in_queue > 200)
-            {
-                peep->time_in_queue -= 200;
-            }
-            else
-            {
-                peep->time_in_queue = 0;
+                if (guest->state == PEEP_STATE_WALKING)
+                {
+                    guest->happiness_target = std::min(guest->happiness_target + 4, PEEP_MAX_HAPPINESS);
+                }
+                else if (guest->state == PEEP_STATE_QUEUING)
+                {
+                    if (guest->time_in_queue > 200)
+                    {
+                        guest->time_in_queue -= 200;
+                    }
+                    else
+                    {
+                        guest->time_in_queue = 0;
+                    }
+                    guest->happiness_target = std::min(guest->happiness_target + 3, PEEP_MAX_HAPPINESS);
+                }
             }
-            peep->happiness_target = std::min(peep->happiness_target + 3, PEEP_MAX_HAPPINESS);
         }
     }
 }
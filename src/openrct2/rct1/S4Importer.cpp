@@ -200,6 +200,7 @@ public:
         ImportScenarioObjective();
         ImportSavedView();
         FixLandOwnership();
+        ride_rebuild_queues();
         FixUrbanPark();
         CountBlockSections();
         SetDefaultNames();
@@ -198,6 +198,10 @@ uint8_t gRideEntranceExitPlaceDirection;
 
 uint8_t gLastEntranceStyle;
 
+// The guest directly behind each queuing guest, i.e. the inverse of Peep::next_in_queue. This is not saved and gets
+// rebuilt by ride_rebuild_queues when a park is loaded.
+static uint16_t _queueGuestBehind[MAX_SPRITES];
+
 // Static function declarations
 Peep* find_closest_mechanic(int32_t x, int32_t y, int32_t forInspection);
 static void ride_breakdown_status_update(Ride* ride);
@@ -355,28 +359,27 @@ int32_t Ride::GetMaxQueueTime() const
 
 Peep* Ride::GetQueueHeadGuest(int32_t stationIndex) const
 {
-    Peep* peep;
-    Peep* result = nullptr;
-    uint16_t spriteIndex = stations[stationIndex].LastPeepInQueue;
-    while ((peep = try_get_guest(spriteIndex)) != nullptr)
-    {
-        spriteIndex = peep->next_in_queue;
-        result = peep;
-    }
-    return result;
+    const auto& station = stations[stationIndex];
+    if (station.LastPeepInQueue == SPRITE_INDEX_NULL)
+        return nullptr;
+    return try_get_guest(station.FirstPeepInQueue);
 }
 
-void Ride::UpdateQueueLength(int32_t stationIndex)
+void Ride::RebuildQueue(int32_t stationIndex)
 {
-    uint16_t count = 0;
+    // QueueLength is kept as saved, so that all network peers keep agreeing on it.
+    auto& station = stations[stationIndex];
+    uint16_t behindIndex = SPRITE_INDEX_NULL;
+    uint16_t spriteIndex = station.LastPeepInQueue;
     Peep* peep;
-    uint16_t spriteIndex = stations[stationIndex].LastPeepInQueue;
-    while ((peep = try_get_guest(spriteIndex)) != nullptr)
+    // Bound the walk, a corrupted save could contain a cycle
+    for (int32_t count = 0; count < MAX_SPRITES && (peep = try_get_guest(spriteIndex)) != nullptr; count++)
     {
+        _queueGuestBehind[spriteIndex] = behindIndex;
+        behindIndex = spriteIndex;
         spriteIndex = peep->next_in_queue;
-        count++;
     }
-    stations[stationIndex].QueueLength = count;
+    station.FirstPeepInQueue = behindIndex;
 }
 
 void Ride::QueueInsertGuestAtFront(int32_t stationIndex, Peep* peep)
@@ -384,17 +387,116 @@ void Ride::QueueInsertGuestAtFront(int32_t stationIndex, Peep* peep)
     assert(stationIndex < MAX_STATIONS);
     assert(peep != nullptr);
 
+    auto& station = stations[stationIndex];
     peep->next_in_queue = SPRITE_INDEX_NULL;
-    Peep* queueHeadGuest = GetQueueHeadGuest(peep->current_ride_station);
+    Peep* queueHeadGuest = GetQueueHeadGuest(stationIndex);
     if (queueHeadGuest == nullptr)
     {
-        stations[peep->current_ride_station].LastPeepInQueue = peep->sprite_index;
+        station.LastPeepInQueue = peep->sprite_index;
+        _queueGuestBehind[peep->sprite_index] = SPRITE_INDEX_NULL;
     }
     else
     {
         queueHeadGuest->next_in_queue = peep->sprite_index;
+        _queueGuestBehind[peep->sprite_index] = queueHeadGuest->sprite_index;
+    }
+    station.FirstPeepInQueue = peep->sprite_index;
+    station.QueueLength++;
+}
+
+void Ride::QueueInsertGuestAtBack(int32_t stationIndex, Peep* peep)
+{
+    assert(stationIndex < MAX_STATIONS);
+    assert(peep != nullptr);
+
+    auto& station = stations[stationIndex];
+    uint16_t previousLast = station.LastPeepInQueue;
+    if (previousLast >= MAX_SPRITES)
+    {
+        station.FirstPeepInQueue = peep->sprite_index;
+    }
+    else
+    {
+        _queueGuestBehind[previousLast] = peep->sprite_index;
+    }
+    _queueGuestBehind[peep->sprite_index] = SPRITE_INDEX_NULL;
+    station.LastPeepInQueue = peep->sprite_index;
+    peep->next_in_queue = previousLast;
+    station.QueueLength++;
+}
+
+void Ride::QueueRemoveGuest(int32_t stationIndex, Peep* peep)
+{
+    assert(stationIndex < MAX_STATIONS);
+    assert(peep != nullptr);
+
+    auto& station = stations[stationIndex];
+    // Make sure we don't underflow, building while paused might reset it to 0 where peeps have
+    // not yet left the queue.
+    if (station.QueueLength > 0)
+    {
+        station.QueueLength--;
+    }
+
+    uint16_t behindIndex = SPRITE_INDEX_NULL;
+    if (peep->sprite_index != station.LastPeepInQueue)
+    {
+        // Only unlink the guest if it is still part of this queue, the queue may have been reset under it
+        Peep* behindGuest = try_get_guest(_queueGuestBehind[peep->sprite_index]);
+        if (behindGuest == nullptr || behindGuest->next_in_queue != peep->sprite_index)
+            return;
+
+        behindIndex = behindGuest->sprite_index;
+        behindGuest->next_in_queue = peep->next_in_queue;
+    }
+    else
+    {
+        station.LastPeepInQueue = peep->next_in_queue;
+    }
+
+    if (peep->next_in_queue < MAX_SPRITES)
+    {
+        _queueGuestBehind[peep->next_in_queue] = behindIndex;
+    }
+    else
+    {
+        station.FirstPeepInQueue = behindIndex;
+    }
+    _queueGuestBehind[peep->sprite_index] = SPRITE_INDEX_NULL;
+}
+
+void Ride::QueueClear(int32_t stationIndex)
+{
+    // Guests keep following each other after the queue is reset, detach them so they don't unlink each other once
+    // they leave.
+    auto& station = stations[stationIndex];
+    uint16_t spriteIndex = station.LastPeepInQueue;
+    Peep* peep;
+    for (int32_t count = 0; count < MAX_SPRITES && (peep = try_get_guest(spriteIndex)) != nullptr; count++)
+    {
+        _queueGuestBehind[spriteIndex] = SPRITE_INDEX_NULL;
+        spriteIndex = peep->next_in_queue;
+    }
+    station.LastPeepInQueue = SPRITE_INDEX_NULL;
+    station.QueueLength = 0;
+}
+
+/**
+ * Rebuilds the queue links that are not part of the save, must be called after rides and sprites have been imported.
+ */
+void ride_rebuild_queues()
+{
+    std::fill(std::begin(_queueGuestBehind), std::end(_queueGuestBehind), SPRITE_INDEX_NULL);
+
+    int32_t rideIndex;
+    Ride* ride;
+    FOR_ALL_RIDES (rideIndex, ride)
+    {
+        for (int32_t stationIndex = 0; stationIndex < MAX_STATIONS; stationIndex++)
+        {
+            ride->RebuildQueue(stationIndex);
+        }
     }
-    UpdateQueueLength(peep->current_ride_station);
 }
 
 /**
@@ -156,6 +156,7 @@ struct RideStation
     uint8_t QueueTime;
     uint16_t QueueLength;
     uint16_t LastPeepInQueue;
+    uint16_t FirstPeepInQueue; // Not saved, only valid while LastPeepInQueue is set.
 
     static constexpr uint8_t NO_TRAIN = std::numeric_limits<uint8_t>::max();
 };
@@ -374,7 +375,6 @@ private:
     void Update();
     void UpdateChairlift();
     void UpdateSpiralSlide();
-    void UpdateQueueLength(int32_t stationIndex);
     money32 CalculateIncomePerHour() const;
 
 public:
@@ -414,6 +414,10 @@ public:
     int32_t GetMaxQueueTime() const;
 
     void QueueInsertGuestAtFront(int32_t stationIndex, Peep* peep);
+    void QueueInsertGuestAtBack(int32_t stationIndex, Peep* peep);
+    void QueueRemoveGuest(int32_t stationIndex, Peep* peep);
+    void QueueClear(int32_t stationIndex);
+    void RebuildQueue(int32_t stationIndex);
     Peep* GetQueueHeadGuest(int32_t stationIndex) const;
 
     static void UpdateAll();
@@ -1044,6 +1048,7 @@ extern uint8_t gLastEntranceStyle;
 ride_id_t ride_get_empty_slot();
 int32_t ride_get_count();
 void ride_init_all();
+void ride_rebuild_queues();
 void reset_all_ride_build_dates();
 void ride_update_favourited_stat();
 void ride_check_all_reachable();
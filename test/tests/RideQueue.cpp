@@ -0,0 +1,176 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/peep/Peep.h>
+#include <openrct2/ride/Ride.h>
+#include <openrct2/world/Sprite.h>
+#include <vector>
+
+class RideQueueTest : public testing::Test
+{
+protected:
+    static constexpr int32_t NUM_GUESTS = 2000;
+    static constexpr int32_t STATION_INDEX = 0;
+
+    Ride* _ride = nullptr;
+    std::vector<Peep*> _guests;
+
+    void SetUp() override
+    {
+        reset_sprite_list();
+        ride_init_all();
+
+        _ride = get_ride(0);
+        _ride->type = RIDE_TYPE_WOODEN_ROLLER_COASTER;
+        _ride->QueueClear(STATION_INDEX);
+        ride_rebuild_queues();
+
+        _guests.clear();
+        for (int32_t i = 0; i < NUM_GUESTS; i++)
+        {
+            Peep* guest = &create_sprite(SPRITE_IDENTIFIER_PEEP)->peep;
+            guest->sprite_identifier = SPRITE_IDENTIFIER_PEEP;
+            guest->type = PEEP_TYPE_GUEST;
+            guest->current_ride = 0;
+            guest->current_ride_station = STATION_INDEX;
+            _guests.push_back(guest);
+        }
+    }
+
+    // Walks the saved next_in_queue chain from the back of the queue, like older versions did
+    std::vector<uint16_t> WalkQueue() const
+    {
+        std::vector<uint16_t> result;
+        uint16_t spriteIndex = _ride->stations[STATION_INDEX].LastPeepInQueue;
+        while (spriteIndex != SPRITE_INDEX_NULL && result.size() <= MAX_SPRITES)
+        {
+            result.push_back(spriteIndex);
+            spriteIndex = GET_PEEP(spriteIndex)->next_in_queue;
+        }
+        return result;
+    }
+
+    void AssertQueueConsistent() const
+    {
+        auto chain = WalkQueue();
+        const auto& station = _ride->stations[STATION_INDEX];
+        ASSERT_EQ(station.QueueLength, chain.size());
+        if (chain.empty())
+        {
+            ASSERT_EQ(_ride->GetQueueHeadGuest(STATION_INDEX), nullptr);
+        }
+        else
+        {
+            ASSERT_NE(_ride->GetQueueHeadGuest(STATION_INDEX), nullptr);
+            ASSERT_EQ(_ride->GetQueueHeadGuest(STATION_INDEX)->sprite_index, chain.back());
+        }
+    }
+};
+
+TEST_F(RideQueueTest, fill_and_drain_from_front)
+{
+    for (auto guest : _guests)
+    {
+        _ride->QueueInsertGuestAtBack(STATION_INDEX, guest);
+    }
+    AssertQueueConsistent();
+    ASSERT_EQ(_ride->stations[STATION_INDEX].QueueLength, NUM_GUESTS);
+    ASSERT_EQ(_ride->stations[STATION_INDEX].LastPeepInQueue, _guests.back()->sprite_index);
+    ASSERT_EQ(_ride->GetQueueHeadGuest(STATION_INDEX), _guests.front());
+
+    // Guests leave in the order they joined
+    for (auto guest : _guests)
+    {
+        ASSERT_EQ(_ride->GetQueueHeadGuest(STATION_INDEX), guest);
+        guest->RemoveFromQueue();
+    }
+    AssertQueueConsistent();
+    ASSERT_EQ(_ride->stations[STATION_INDEX].QueueLength, 0);
+    ASSERT_EQ(_ride->stations[STATION_INDEX].LastPeepInQueue, SPRITE_INDEX_NULL);
+}
+
+TEST_F(RideQueueTest, fill_at_front_and_drain_from_back)
+{
+    for (auto guest : _guests)
+    {
+        _ride->QueueInsertGuestAtFront(STATION_INDEX, guest);
+    }
+    AssertQueueConsistent();
+    ASSERT_EQ(_ride->GetQueueHeadGuest(STATION_INDEX), _guests.back());
+    ASSERT_EQ(_ride->stations[STATION_INDEX].LastPeepInQueue, _guests.front()->sprite_index);
+
+    for (auto guest : _guests)
+    {
+        ASSERT_EQ(_ride->stations[STATION_INDEX].LastPeepInQueue, guest->sprite_index);
+        guest->RemoveFromQueue();
+    }
+    AssertQueueConsistent();
+    ASSERT_EQ(_ride->stations[STATION_INDEX].LastPeepInQueue, SPRITE_INDEX_NULL);
+}
+
+TEST_F(RideQueueTest, drain_from_middle)
+{
+    for (auto guest : _guests)
+    {
+        _ride->QueueInsertGuestAtBack(STATION_INDEX, guest);
+    }
+
+    // Every other guest gives up, then the rest leave in reverse order
+    for (size_t i = 1; i < _guests.size(); i += 2)
+    {
+        _guests[i]->RemoveFromQueue();
+    }
+    AssertQueueConsistent();
+    ASSERT_EQ(_ride->stations[STATION_INDEX].QueueLength, NUM_GUESTS / 2);
+
+    for (size_t i = 0; i < _guests.size(); i += 2)
+    {
+        _guests[_guests.size() - 2 - i]->RemoveFromQueue();
+        AssertQueueConsistent();
+    }
+    ASSERT_EQ(_ride->stations[STATION_INDEX].QueueLength, 0);
+}
+
+TEST_F(RideQueueTest, rebuild_matches_loaded_queue)
+{
+    for (auto guest : _guests)
+    {
+        _ride->QueueInsertGuestAtBack(STATION_INDEX, guest);
+    }
+    auto before = WalkQueue();
+
+    // Simulate a load, where only next_in_queue and LastPeepInQueue are known
+    ride_rebuild_queues();
+    AssertQueueConsistent();
+    ASSERT_EQ(WalkQueue(), before);
+
+    _guests[NUM_GUESTS / 2]->RemoveFromQueue();
+    _ride->QueueInsertGuestAtFront(STATION_INDEX, _guests[NUM_GUESTS / 2]);
+    AssertQueueConsistent();
+    ASSERT_EQ(_ride->GetQueueHeadGuest(STATION_INDEX), _guests[NUM_GUESTS / 2]);
+}
+
+TEST_F(RideQueueTest, remove_after_clear_is_ignored)
+{
+    for (int32_t i = 0; i < 10; i++)
+    {
+        _ride->QueueInsertGuestAtBack(STATION_INDEX, _guests[i]);
+    }
+    _ride->QueueClear(STATION_INDEX);
+    _ride->QueueInsertGuestAtBack(STATION_INDEX, _guests[10]);
+
+    // Guests from the old queue still think they are queuing
+    for (int32_t i = 0; i < 10; i++)
+    {
+        _guests[i]->RemoveFromQueue();
+    }
+    ASSERT_EQ(_ride->stations[STATION_INDEX].LastPeepInQueue, _guests[10]->sprite_index);
+    ASSERT_EQ(_ride->GetQueueHeadGuest(STATION_INDEX), _guests[10]);
+}